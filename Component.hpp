@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "Notifiable.hpp"
 
 namespace dn
@@ -40,4 +43,53 @@ namespace dn
     private:
         bool _active;
     };
+
+    // A buffered component is published by the scene at the end of every update.
+    struct BufferedComponentBase : public dn::Component
+    {
+        virtual void publish() = 0;
+    };
+
+    // A buffered component keeps two copies of its data: the engines write to the back buffer during the update,
+    // while consumers on other threads (rendering, network...) read the front buffer, the snapshot of the last frame.
+    template <typename T_Data>
+    struct BufferedComponent : public dn::BufferedComponentBase
+    {
+        // Builds the data in place, this constructor is disabled for a single buffered component argument,
+        // so that it never takes over the copy constructor.
+        template <typename ... T_Args, typename = std::enable_if_t<
+            sizeof...(T_Args) != 1 || !(std::is_base_of_v<BufferedComponent, std::decay_t<T_Args>> && ...)>>
+        BufferedComponent(T_Args && ... p_args)
+            : _front(std::forward<T_Args>(p_args)...), _back(_front)
+        {}
+
+        // The data being written for the current frame.
+        T_Data &back()
+        {
+            return this->_back;
+        }
+
+        // The data of the last completed frame.
+        const T_Data &front() const
+        {
+            return this->_front;
+        }
+
+        // Publishes the back buffer by copying it into the front buffer, the whole of T_Data is copied every frame.
+        // The back buffer keeps its values so the next frame starts from them.
+        void publish()
+        {
+            this->_front = this->_back;
+        }
+
+    private:
+        T_Data _front;
+        T_Data _back;
+    };
+
+    // A tag is an empty, default constructible type that does not inherit from dn::Component (Enemy, Selected, Frozen...).
+    // It carries no data, so instead of being allocated it is stored as a single bit in the object's signature.
+    template <typename T_Component>
+    constexpr bool isTag = std::is_empty_v<T_Component> && std::is_default_constructible_v<T_Component>
+        && !std::is_base_of_v<dn::Component, T_Component>;
 }
\ No newline at end of file
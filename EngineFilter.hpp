@@ -62,12 +62,7 @@ namespace dn
         // Tests if the given object passes the filter.
         static bool passFilter(dn::Object *p_object)
         {
-            return (passFilterComponent(p_object->getComponent<T_Components>()) && ...);
-        }
-
-        static bool passFilterComponent(dn::Component *p_component)
-        {
-            return p_component != nullptr && p_component->active();
+            return (p_object->hasComponent<T_Components>() && ...);
         }
 
     protected:
@@ -0,0 +1,105 @@
+/*
+
+    An EventChannel carries events of one type (collisions, damages, triggers...) from producers to engines.
+    Events are published once per frame, and read as a contiguous batch.
+
+*/
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <utility>
+#include <type_traits>
+
+namespace dn
+{
+    // The scene stores its channels without knowing their event type, it only needs to flush them.
+    class EventChannelBase
+    {
+    public:
+        virtual ~EventChannelBase()
+        {}
+
+        virtual void flush() = 0;
+    };
+
+    // Events emitted during a frame are appended to the pending buffer, they are readable the next frame,
+    // once the scene has flushed the channel at the end of its update. This way every engine sees all the events
+    // of a frame, whatever the order in which the engines are updated.
+    // The two buffers are swapped and cleared, never freed, so there is no allocation once they have grown enough.
+    template <typename T_Event>
+    class EventChannel : public dn::EventChannelBase
+    {
+    public:
+        // Appends an event, it can be called from multiple threads.
+        void emit(const T_Event &p_event)
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending.push_back(p_event);
+        }
+
+        void emit(T_Event &&p_event)
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending.push_back(std::move(p_event));
+        }
+
+        // Appends an event built in place from the arguments, it is brace initialized so plain structs work.
+        // It is disabled for a single event argument, the overloads above copy or move it instead.
+        template <typename ... T_Args, typename = std::enable_if_t<
+            sizeof...(T_Args) != 1 || !(std::is_same_v<T_Event, std::decay_t<T_Args>> && ...)>>
+        void emit(T_Args && ... p_args)
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending.push_back(T_Event{std::forward<T_Args>(p_args)...});
+        }
+
+        // Appends a batch of events, the lock is taken once for the whole batch.
+        template <typename T_Iterator>
+        void emitRange(T_Iterator p_begin, T_Iterator p_end)
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending.insert(this->_pending.end(), p_begin, p_end);
+        }
+
+        // Returns the events emitted during the last frame.
+        const std::vector<T_Event> &events() const
+        {
+            return this->_events;
+        }
+
+        const T_Event *begin() const
+        {
+            return this->_events.data();
+        }
+
+        const T_Event *end() const
+        {
+            return this->_events.data() + this->_events.size();
+        }
+
+        // Reserves space in both buffers, to avoid growing them during the first frames.
+        void reserve(std::size_t p_size)
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending.reserve(p_size);
+            this->_events.reserve(p_size);
+        }
+
+        // Publishes the pending events, and drops the ones of the last frame.
+        // This function is called by the scene at the end of its update.
+        void flush()
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_events.swap(this->_pending);
+            this->_pending.clear();
+        }
+
+    private:
+        std::vector<T_Event> _events;
+        std::vector<T_Event> _pending;
+
+        std::mutex _mutex;
+    };
+}
\ No newline at end of file
@@ -39,6 +39,127 @@ namespace dn
         // Attaches a component of type T_Component to the object.
         template <typename T_Component, typename ... T_Args>
         T_Component *addComponent(T_Args && ... p_args)
+        {
+            // Tags are only a bit flip, the object is still notified so the engines re-evaluate their filters.
+            if constexpr (dn::isTag<T_Component>)
+            {
+                static_assert(sizeof...(T_Args) == 0, "A tag component holds no data, it cannot be constructed with arguments.");
+
+                if (!this->hasTag<T_Component>())
+                {
+                    this->setTag<T_Component>(true);
+                    this->notifier().notify(this);
+                }
+                return Object::tagInstance<T_Component>();
+            }
+            else
+                return this->addDataComponent<T_Component>(std::forward<T_Args>(p_args)...);
+        }
+
+        // Returns the component of that type.
+        // Looking up components is not thread safe, it must only be done from the scene's thread,
+        // other threads read the buffered components published by the scene (see dn::Scene::forEachPublished).
+        // For a tag, a shared instance is returned if the object has it, since a tag holds no data.
+        template <typename T_Component>
+        T_Component *getComponent()
+        {
+            if constexpr (dn::isTag<T_Component>)
+                return this->hasTag<T_Component>() ? Object::tagInstance<T_Component>() : nullptr;
+            else
+            {
+                auto &&it = this->_components.find(dn::getType<T_Component>());
+
+                if (it != this->_components.end())
+                    return dynamic_cast<T_Component *>(it->second);
+                return nullptr;
+            }
+        }
+
+        // Returns if the object has an active component of that type.
+        template <typename T_Component>
+        bool hasComponent()
+        {
+            if constexpr (dn::isTag<T_Component>)
+                return this->hasTag<T_Component>();
+            else
+            {
+                T_Component *component = this->getComponent<T_Component>();
+                return component != nullptr && component->active();
+            }
+        }
+
+        // Remove the component of that type.
+        template <typename T_Component>
+        bool removeComponent()
+        {
+            if constexpr (dn::isTag<T_Component>)
+            {
+                // A tag owns nothing, so there is nothing to put in the trash.
+                if (!this->hasTag<T_Component>())
+                    return false;
+                this->setTag<T_Component>(false);
+                this->notifier().notify(this);
+                return true;
+            }
+            else
+            {
+                auto &&it = this->_components.find(dn::getType<T_Component>());
+
+                if (it == this->_components.end())
+                    return false;
+                this->_trash.push_back(it);
+                this->_trashNotifier.notify(this, true);
+                it->second->setActive(false);
+                return true;
+            }
+        }
+
+        // Cleans the trash of components.
+        void cleanTrash()
+        {
+            for (auto &&c : this->_trash)
+            {
+                auto &&itBuffered = std::find_if(this->_buffered.begin(), this->_buffered.end(), [&c](const BufferedEntry &p_entry) {
+                    return p_entry.second == c->second;
+                });
+                if (itBuffered != this->_buffered.end())
+                {
+                    this->_buffered.erase(itBuffered);
+                    // The scene no longer needs to publish this object.
+                    if (this->_buffered.empty())
+                        this->_bufferedNotifier.notify(this, false);
+                }
+                delete c->second;
+                this->_components.erase(c);
+            }
+            this->_trash.clear();
+        }
+
+        // Each buffered component with the type it was added as.
+        using BufferedEntry = std::pair<const std::type_info *, dn::BufferedComponentBase *>;
+
+        // Returns the buffered components, the scene publishes them at the end of its update.
+        const std::vector<BufferedEntry> &bufferedComponents() const
+        {
+            return this->_buffered;
+        }
+
+        // Notified with true when the object gets its first buffered component, and false when it loses its last one.
+        dn::Notifier<dn::Object *, const bool &> &bufferedNotifier()
+        {
+            return this->_bufferedNotifier;
+        }
+
+        dn::Notifier<dn::Object *, const bool &> &trashNotifier()
+        {
+            return this->_trashNotifier;
+        }
+
+        std::string name;
+    private:
+        // Attaches a component that holds data, it is allocated and stored in the components map.
+        template <typename T_Component, typename ... T_Args>
+        T_Component *addDataComponent(T_Args && ... p_args)
         {
             auto &&it = this->_components.find(dn::getType<T_Component>());
 
@@ -61,56 +182,49 @@ namespace dn
                 this->notifier().notify(this);
             });
             this->_components.emplace(dn::getType<T_Component>(), (dn::Component *)comp);
+            if constexpr (std::is_base_of_v<dn::BufferedComponentBase, T_Component>)
+            {
+                this->_buffered.emplace_back(dn::getType<T_Component>(), comp);
+                if (this->_buffered.size() == 1)
+                    this->_bufferedNotifier.notify(this, true);
+            }
             this->notifier().notify(this);
             return comp;
         }
 
-        // Returns the component of that type.
         template <typename T_Component>
-        T_Component *getComponent()
+        bool hasTag() const
         {
-            auto &&it = this->_components.find(dn::getType<T_Component>());
-
-            if (it != this->_components.end())
-                return dynamic_cast<T_Component *>(it->second);
-            return nullptr;
+            std::size_t index = dn::getTypeIndex<T_Component>();
+            return index < this->_tags.size() && this->_tags[index];
         }
 
-        // Remove the component of that type.
         template <typename T_Component>
-        bool removeComponent()
+        void setTag(bool p_state)
         {
-            auto &&it = this->_components.find(dn::getType<T_Component>());
+            std::size_t index = dn::getTypeIndex<T_Component>();
 
-            if (it == this->_components.end())
-                return false;
-            this->_trash.push_back(it);
-            this->_trashNotifier.notify(this, true);
-            it->second->setActive(false);
-            return true;
+            if (index >= this->_tags.size())
+                this->_tags.resize(index + 1, false);
+            this->_tags[index] = p_state;
         }
 
-        // Cleans the trash of components.
-        void cleanTrash()
-        {
-            for (auto &&c : this->_trash)
-            {
-                delete c->second;
-                this->_components.erase(c);
-            }
-            this->_trash.clear();
-        }
-
-        dn::Notifier<dn::Object *, const bool &> &trashNotifier()
+        // The instance returned for a tag, it is shared by all the objects.
+        template <typename T_Component>
+        static T_Component *tagInstance()
         {
-            return this->_trashNotifier;
+            static T_Component instance;
+            return &instance;
         }
 
-        std::string name;
-    private:
         std::map<const std::type_info *, dn::Component *> _components;
         std::vector<std::map<const std::type_info *, dn::Component *>::iterator> _trash;
+        // The buffered components, they are also stored in the components map.
+        std::vector<BufferedEntry> _buffered;
+        // The object's signature of tags, one bit per tag type.
+        std::vector<bool> _tags;
 
         dn::Notifier<dn::Object *, const bool &> _trashNotifier;
+        dn::Notifier<dn::Object *, const bool &> _bufferedNotifier;
     };
 }
\ No newline at end of file
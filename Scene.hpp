@@ -8,9 +8,14 @@
 
 #include <map>
 #include <vector>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
 
 #include "Object.hpp"
 #include "Engine.hpp"
+#include "EventChannel.hpp"
 #include "Notifiable.hpp"
 
 namespace dn
@@ -20,7 +25,7 @@ namespace dn
     {
     public:
         Scene()
-            : _started(false)
+            : _started(false), _published(false), _frame(0)
         {
             this->_trashNotifier.onNotification([this](dn::Object *p_object, const bool &p_state) {
                 if (p_state)
@@ -32,12 +37,25 @@ namespace dn
                         this->_objectsNeedClean.erase(it);
                 }
             });
+
+            // Only the objects owning buffered components are walked when publishing.
+            this->_bufferedNotifier.onNotification([this](dn::Object *p_object, const bool &p_state) {
+                auto &&it = std::find(this->_bufferedObjects.begin(), this->_bufferedObjects.end(), p_object);
+
+                if (p_state && it == this->_bufferedObjects.end()
+                    && std::find(this->_objects.begin(), this->_objects.end(), p_object) != this->_objects.end())
+                    this->_bufferedObjects.push_back(p_object);
+                else if (!p_state && it != this->_bufferedObjects.end())
+                    this->_bufferedObjects.erase(it);
+            });
         }
 
         ~Scene()
         {
             for (auto &&engine : this->_engines)
                 delete engine.second;
+            for (auto &&channel : this->_channels)
+                delete channel.second;
         }
 
     public:
@@ -65,9 +83,53 @@ namespace dn
                 engine.second->cleanTrash();
             }
 
+            // The events emitted during this update become readable by the next one.
+            {
+                std::shared_lock<std::shared_mutex> lock(this->_channelsMutex);
+                for (auto &&channel : this->_channels)
+                    channel.second->flush();
+            }
+
+            // The consumers must not read while the snapshot is replaced, or while published components are destroyed.
+            // The lock is only taken if there is something published, or something to publish.
+            std::unique_lock<std::shared_mutex> lock(this->_snapshotMutex, std::defer_lock);
+            if (this->_published || !this->_bufferedObjects.empty())
+                lock.lock();
+
             for (auto &&object : this->_objectsNeedClean)
                 object->cleanTrash();
             this->_objectsNeedClean.clear();
+
+            if (lock.owns_lock())
+                this->publish();
+            ++this->_frame;
+        }
+
+        // Locks the snapshot of the last frame, the published buffered components can be read safely
+        // from another thread as long as the returned lock is held. The next update waits for it to be released.
+        std::shared_lock<std::shared_mutex> snapshot()
+        {
+            return std::shared_lock<std::shared_mutex>(this->_snapshotMutex);
+        }
+
+        // Calls the function with each active T_Component published at the end of the last update.
+        // It is the way for other threads to reach buffered components, since object lookups are scene thread only,
+        // and it must be called while holding the lock returned by snapshot().
+        template <typename T_Component, typename T_Function>
+        void forEachPublished(T_Function &&p_function) const
+        {
+            auto &&it = this->_snapshots.find(dn::getType<T_Component>());
+
+            if (it == this->_snapshots.end())
+                return;
+            for (auto &&component : it->second)
+                p_function(*static_cast<const T_Component *>(component));
+        }
+
+        // Returns the number of completed updates, the front buffers hold the state of that frame.
+        std::size_t frame() const
+        {
+            return this->_frame;
         }
 
         // Adds an object to the scene, and sends it the engines.
@@ -79,6 +141,9 @@ namespace dn
             p_object->notifier().connect(this->notifier());
 
             p_object->trashNotifier().connect(this->_trashNotifier);
+            p_object->bufferedNotifier().connect(this->_bufferedNotifier);
+            if (!p_object->bufferedComponents().empty())
+                this->_bufferedObjects.push_back(p_object);
 
             for (auto &&engine : this->_engines)
                 engine.second->updateObject(p_object);
@@ -94,6 +159,22 @@ namespace dn
             for (auto &&engine : this->_engines)
                 engine.second->updateObject(p_object, true);
             this->_objects.erase(it);
+
+            auto &&itBuffered = std::find(this->_bufferedObjects.begin(), this->_bufferedObjects.end(), p_object);
+            if (itBuffered == this->_bufferedObjects.end())
+                return;
+            this->_bufferedObjects.erase(itBuffered);
+
+            // Its published components are withdrawn right away, the object may be destroyed before the next update.
+            std::unique_lock<std::shared_mutex> lock(this->_snapshotMutex);
+            for (auto &&entry : p_object->bufferedComponents())
+            {
+                auto &&snapshot = this->_snapshots[entry.first];
+                auto &&itSnapshot = std::find(snapshot.begin(), snapshot.end(), entry.second);
+
+                if (itSnapshot != snapshot.end())
+                    snapshot.erase(itSnapshot);
+            }
         }
 
         // Adds an engine to the scene.
@@ -138,13 +219,75 @@ namespace dn
             this->_engines.erase(it);
         }
 
+        // Returns the channel of that event type, it is created the first time it is asked for.
+        // It can be called from multiple threads, looking up a channel only takes the shared side of the lock.
+        // Keeping the returned reference (in onStart for example) avoids the lookup altogether.
+        template <typename T_Event>
+        dn::EventChannel<T_Event> &channel()
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock(this->_channelsMutex);
+                auto &&it = this->_channels.find(dn::getType<T_Event>());
+
+                if (it != this->_channels.end())
+                    return *static_cast<dn::EventChannel<T_Event> *>(it->second);
+            }
+
+            std::unique_lock<std::shared_mutex> lock(this->_channelsMutex);
+            auto &&it = this->_channels.find(dn::getType<T_Event>());
+
+            // Another thread may have created it in the meantime.
+            if (it == this->_channels.end())
+                it = this->_channels.emplace(dn::getType<T_Event>(), new dn::EventChannel<T_Event>).first;
+            return *static_cast<dn::EventChannel<T_Event> *>(it->second);
+        }
+
+        // Emits an event in the channel of that type, creating the channel if needed.
+        // It can be called from multiple threads, like channel().
+        template <typename T_Event, typename ... T_Args>
+        void emit(T_Args && ... p_args)
+        {
+            this->channel<T_Event>().emit(std::forward<T_Args>(p_args)...);
+        }
+
     private:
+        // Copies the back buffers to the front buffers, and rebuilds the list of components readable by other threads.
+        // Called with the snapshot lock held exclusively.
+        void publish()
+        {
+            for (auto &&snapshot : this->_snapshots)
+                snapshot.second.clear();
+
+            for (auto &&object : this->_bufferedObjects)
+            {
+                for (auto &&entry : object->bufferedComponents())
+                {
+                    if (!entry.second->active())
+                        continue;
+                    entry.second->publish();
+                    this->_snapshots[entry.first].push_back(entry.second);
+                }
+            }
+            this->_published = !this->_bufferedObjects.empty();
+        }
+
         std::map<const std::type_info *, dn::EngineHelper<> *> _engines;
+        std::map<const std::type_info *, dn::EventChannelBase *> _channels;
+        std::shared_mutex _channelsMutex;
 
         std::vector<dn::Object *> _objects;
         std::vector<dn::Object *> _objectsNeedClean;
         dn::Notifier<dn::Object *, const bool &> _trashNotifier;
 
         bool _started;
+
+        // The objects owning buffered components, and the components published for each type.
+        std::vector<dn::Object *> _bufferedObjects;
+        dn::Notifier<dn::Object *, const bool &> _bufferedNotifier;
+        std::map<const std::type_info *, std::vector<const dn::BufferedComponentBase *>> _snapshots;
+        bool _published;
+
+        std::shared_mutex _snapshotMutex;
+        std::atomic<std::size_t> _frame;
     };
 }
\ No newline at end of file
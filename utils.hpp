@@ -1,6 +1,8 @@
 #pragma once
 
 #include <typeinfo>
+#include <type_traits>
+#include <cstddef>
 
 namespace dn
 {
@@ -16,4 +18,19 @@ namespace dn
     {
         return dn::getType<T_Type>();
     }
+
+    // Returns a unique index for each type, starting from 0, in the order they are first asked for.
+    // It is used to give each tag component its own bit in an object's signature.
+    inline std::size_t nextTypeIndex()
+    {
+        static std::size_t index = 0;
+        return index++;
+    }
+
+    template <typename T_Type>
+    std::size_t getTypeIndex()
+    {
+        static const std::size_t index = dn::nextTypeIndex();
+        return index;
+    }
 }
\ No newline at end of file